@@ -5,6 +5,7 @@
 
 namespace Format {
 std::string ElapsedTime(long times);  // DONE: See src/format.cpp
-};                                    // namespace Format
+std::string Rate(float bytesPerSecond);
+};  // namespace Format
 
 #endif
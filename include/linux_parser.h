@@ -5,6 +5,7 @@
 #include <regex>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 using namespace std;
 
@@ -40,8 +41,13 @@ const string kStatFilename{"/stat"};
 const string kUptimeFilename{"/uptime"};
 const string kMeminfoFilename{"/meminfo"};
 const string kVersionFilename{"/version"};
+const string kLoadavgFilename{"/loadavg"};
+const string kPressureDirectory{"/pressure/"};
+const string kNetDevFilename{"/net/dev"};
+const string kDiskstatsFilename{"/diskstats"};
 const string kOSPath{"/etc/os-release"};
 const string kPasswordPath{"/etc/passwd"};
+const string kSysBlockDirectory{"/sys/block/"};
 
 // System
 float MemoryUtilization();
@@ -67,12 +73,50 @@ enum CPUStates {
   kGuestNice_
 };
 vector<string> CpuUtilization();
+// Active and idle jiffies of one cpu line in /proc/stat
+struct CpuTime {
+  long active{}, idle{};
+};
+vector<CpuTime> CpuTimes();  // aggregate first, then one entry per core
 long Jiffies();
 long ActiveJiffies();
 long ActiveJiffies(int pid);
 long IdleJiffies();
 
+// Load, pressure and I/O
+constexpr int kSectorSize = 512;  // /proc/diskstats always counts 512B sectors
+const string fLoopback("lo");
+const vector<string> fVirtualDisks{"loop", "ram", "zram"};
+const string fPressureSome("some");
+const string fPressureFull("full");
+const string fAvg10("avg10");
+
+struct LoadAverage {
+  float one{}, five{}, fifteen{};
+};
+struct Pressure {
+  bool available{false};  // false without PSI support (or access to it)
+  float some{}, full{};   // avg10, in percent
+};
+// Cumulative byte counters of a network interface or block device
+struct IoCounters {
+  string name;
+  llu in{}, out{};
+};
+LoadAverage LoadAvg();
+Pressure PressureStall(string const &resource);
+vector<IoCounters> NetDevices();
+vector<IoCounters> DiskStats();
+
 // Processes
+// Fields of /proc/[pid]/stat read in one pass
+struct ProcStat {
+  string comm;           // executable name, changes on exec
+  long activeJiffies{};  // utime + stime + cutime + cstime
+  llu startTime{};       // clock ticks after boot, fixed for the pid lifetime
+};
+bool Stat(int pid, ProcStat &stat);  // false if the process is gone
+long Hertz();                        // clock ticks per second, read once
 string Command(int pid);
 string Ram(int pid);
 string Uid(int pid);
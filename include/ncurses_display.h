@@ -9,8 +9,14 @@
 namespace NCursesDisplay {
 void Display(System& system, int n = 20);
 void DisplaySystem(System& system, WINDOW* window);
-void DisplayProcesses(std::vector<Process>& processes, WINDOW* window, int n);
+void DisplayPanels(System& system, WINDOW* window);
+int PanelsHeight(System& system);
+void DisplayHistory(System const& system, WINDOW* window);
+int HistoryHeight(System const& system, int width);
+void DisplayProcesses(System const& system, std::vector<Process>& processes,
+                      WINDOW* window, int n);
 std::string ProgressBar(float percent);
+std::string Sparkline(History const& history, int width);
 };  // namespace NCursesDisplay
 
 #endif
@@ -11,7 +11,12 @@ It contains relevant attributes as shown below
 class Process {
  public:
   // constructor
-  Process(int);
+  Process(int pid, LinuxParser::ProcStat const& stat, long upTime);
+
+  // Refresh per-frame values; drops cached static fields on exec
+  void Update(LinuxParser::ProcStat const& stat, long upTime);
+  LinuxParser::llu StartTime() const;
+  long ActiveJiffies() const;  // as of the last refresh
 
   int Pid() const;                         // DONE: See src/process.cpp
   std::string User();                      // DONE: See src/process.cpp
@@ -26,6 +31,19 @@ class Process {
  private:
   static constexpr int COMMAND_MAX = 40;
   int pid_;
+
+  // Fixed for the pid lifetime (until exec), loaded on first use
+  LinuxParser::llu startTime_;
+  std::string comm_;
+  std::string command_{};
+  std::string user_{};
+  bool commandLoaded_{false};
+  bool userLoaded_{false};
+
+  // Sampled once per refresh
+  long upTime_{};
+  long jiffies_{};
+  float cpu_{};
 };
 
 #endif
@@ -8,7 +8,12 @@
 using namespace std::literals::chrono_literals;
 class Processor {
  public:
-  float Utilization();  // DONE: See src/processor.cpp
+  // Aggregate utilization over a sample of `interval`
+  // DONE: See src/processor.cpp
+  float Utilization(std::chrono::milliseconds interval = 200ms);
+  // Aggregate utilization since an earlier /proc/stat sample, waiting until
+  // at least `minJiffies` have passed so the result is not quantization noise
+  float Utilization(LinuxParser::CpuTime const& since, long minJiffies);
 
   // DONE: Declare any necessary private members
  private:
@@ -0,0 +1,41 @@
+#ifndef RING_BUFFER_H
+#define RING_BUFFER_H
+
+#include <array>
+#include <cstddef>
+
+/*
+Fixed-capacity history of the last N samples
+Storage is allocated up front; pushing overwrites the oldest sample in O(1)
+*/
+template <typename T, std::size_t N>
+class RingBuffer {
+ public:
+  void Push(T const& value) {
+    data_[head_] = value;
+    head_ = (head_ + 1) % N;
+    if (size_ < N) size_++;
+  }
+
+  // Samples are indexed from the oldest (0) to the newest (Size() - 1)
+  T const& operator[](std::size_t i) const {
+    return data_[(head_ + N - size_ + i) % N];
+  }
+
+  T const& Back() const { return data_[(head_ + N - 1) % N]; }
+  std::size_t Size() const { return size_; }
+  bool Empty() const { return size_ == 0; }
+  static constexpr std::size_t Capacity() { return N; }
+
+  void Clear() {
+    head_ = 0;
+    size_ = 0;
+  }
+
+ private:
+  std::array<T, N> data_{};
+  std::size_t head_{0};
+  std::size_t size_{0};
+};
+
+#endif
@@ -1,14 +1,32 @@
 #ifndef SYSTEM_H
 #define SYSTEM_H
 
+#include <array>
+#include <chrono>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "process.h"
 #include "processor.h"
+#include "ring_buffer.h"
 
 using std::vector;
 
+// Optional panels below the system summary; disabled panels read nothing
+enum class Panel { kLoad = 0, kPressure, kNetwork, kDisk };
+constexpr int N_PANELS = 4;  // Number of elements in Panel
+
+// Bytes per second flowing in/out of a network interface or block device
+struct Throughput {
+  std::string name;
+  float in{}, out{};
+};
+
+// Last samples kept for sparklines, one per refresh
+constexpr std::size_t N_HISTORY = 60;
+using History = RingBuffer<float, N_HISTORY>;
+
 class System {
  public:
   // Constructor
@@ -22,12 +40,56 @@ class System {
   int RunningProcesses();             // DONE: See src/system.cpp
   std::string Kernel();               // DONE: See src/system.cpp
   std::string OperatingSystem();      // DONE: See src/system.cpp
+  LinuxParser::LoadAverage LoadAverage();
+  std::array<LinuxParser::Pressure, 3> Pressure();  // cpu, memory, io
+  std::vector<Throughput> NetThroughput();
+  std::vector<Throughput> DiskThroughput();
+
+  // Record one history sample of cpu, cores, memory and the first
+  // `tracked` processes of the last Processes() call
+  void Sample(std::size_t tracked);
+  // aggregate /proc/stat line as of construction or the last Sample
+  LinuxParser::CpuTime CpuBaseline() const;
+  History const& CpuHistory() const;
+  vector<History> const& CoreHistory() const;
+  History const& MemoryHistory() const;
+  // nullptr if the process (pid + start time) is not tracked
+  History const* ProcessHistory(Process const& process) const;
+
+  bool PanelEnabled(Panel panel) const;
+  void TogglePanel(Panel panel);
 
   // DONE: Define any necessary private members
  private:
   Processor cpu_ {};
   vector<Process> processes_ {};
   vector<int> pids_ {};
+  std::string kernel_ {};           // fixed until reboot
+  std::string operatingSystem_ {};  // fixed until reboot
+
+  // Previous I/O samples used to turn cumulative counters into rates
+  struct IoSample {
+    std::unordered_map<std::string, LinuxParser::IoCounters> counters{};
+    std::chrono::steady_clock::time_point time{};
+  };
+  IoSample net_ {};
+  IoSample disk_ {};
+  std::array<bool, N_PANELS> panels_ {true, true, true, true};
+
+  // Sparkline history; sized once so memory does not grow with uptime
+  static constexpr std::size_t kTrackedProcesses = 20;
+  struct TrackedProcess {
+    int pid{-1};
+    LinuxParser::llu startTime{};
+    long prevJiffies{};  // baseline for the next cpu sample
+    std::chrono::steady_clock::time_point prevTime{};
+    History cpu{};
+  };
+  vector<LinuxParser::CpuTime> prevCpuTimes_ {};
+  History cpuHistory_ {};
+  vector<History> coreHistory_ {};
+  History memoryHistory_ {};
+  std::array<TrackedProcess, kTrackedProcesses> tracked_ {};
 };
 
 #endif
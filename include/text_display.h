@@ -0,0 +1,14 @@
+#ifndef TEXT_DISPLAY_H
+#define TEXT_DISPLAY_H
+
+#include <ostream>
+
+#include "system.h"
+
+// Plain-text, one-shot output for scripts (like top -b -n 1); never touches
+// ncurses
+namespace TextDisplay {
+void Display(System& system, std::ostream& out, int n = 20);
+};  // namespace TextDisplay
+
+#endif
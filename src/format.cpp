@@ -33,3 +33,18 @@ string Format::ElapsedTime(long secs) {
 
   return ss.str();
 }
+
+// INPUT: bytes per second
+// OUTPUT: value scaled to B/s, K/s, M/s or G/s with one decimal
+string Format::Rate(float bytesPerSecond) {
+  const char* units[]{"B/s", "K/s", "M/s", "G/s"};
+  size_t unit{0};
+  while (bytesPerSecond >= 1024 && unit < 3) {
+    bytesPerSecond /= 1024;
+    unit++;
+  }
+
+  stringstream ss{};
+  ss << fixed << setprecision(1) << bytesPerSecond << units[unit];
+  return ss.str();
+}
@@ -148,6 +148,30 @@ vector<string> LinuxParser::CpuUtilization() {
   return cpu;
 }
 
+// Read and return the active/idle jiffies of every cpu line in one pass
+vector<LinuxParser::CpuTime> LinuxParser::CpuTimes() {
+  vector<CpuTime> times;
+  string key, line;
+  long states[N_STATES];
+
+  ifstream filestream(kProcDirectory + kStatFilename);
+  while (getline(filestream, line)) {
+    istringstream linestream(line);
+    linestream >> key;
+    // cpu lines come first: "cpu" followed by "cpu0", "cpu1", ...
+    if (key.compare(0, fCpu.size(), fCpu) != 0) break;
+    for (size_t i = 0; i < N_STATES; i++) {
+      states[i] = 0;
+      linestream >> states[i];
+    }
+    times.push_back(
+        {states[kUser_] + states[kNice_] + states[kSystem_] + states[kIRQ_] +
+             states[kSoftIRQ_] + states[kSteal_],
+         states[kIdle_] + states[kIOwait_]});
+  }
+  return times;
+}
+
 // DONE: Read and return the total number of processes
 int LinuxParser::TotalProcesses() {
   return findValueByKey<int>(fProcesses, kStatFilename);
@@ -158,6 +182,34 @@ int LinuxParser::RunningProcesses() {
   return findValueByKey<int>(fRunningProcesses, kStatFilename);
 }
 
+// Read the cpu time, start time and executable name of a process in one pass
+bool LinuxParser::Stat(int pid, ProcStat& stat) {
+  string line;
+  ifstream stream(kProcDirectory + to_string(pid) + kStatFilename);
+  if (!stream.is_open() || !getline(stream, line)) return false;
+
+  // comm is wrapped in parentheses and may itself contain spaces
+  const auto open{line.find('(')}, close{line.rfind(')')};
+  if (open == string::npos || close == string::npos) return false;
+  stat.comm = line.substr(open + 1, close - open - 1);
+
+  // fields after comm start at field 3 (state)
+  istringstream linestream(line.substr(close + 1));
+  string temp;
+  long utime{}, stime{}, cutime{}, cstime{};
+  for (int i = 3; i < kUTime; i++) linestream >> temp;
+  linestream >> utime >> stime >> cutime >> cstime;
+  for (int i = kCSTime + 1; i < kStartTime; i++) linestream >> temp;
+  linestream >> stat.startTime;
+  stat.activeJiffies = utime + stime + cutime + cstime;
+  return true;
+}
+
+long LinuxParser::Hertz() {
+  static const long hertz{sysconf(_SC_CLK_TCK)};
+  return hertz;
+}
+
 // DONE: Read and return the command associated with a process
 string LinuxParser::Command(int pid) {
   return getValueOfFile<string>(to_string(pid) + kCmdlineFilename);
@@ -206,7 +258,85 @@ string LinuxParser::User(int pid) {
 // DONE: Read and return the uptime of a process
 long LinuxParser::UpTime(int pid) {
   llu start_time{findNthValue<llu>(kStartTime, to_string(pid) + kStatFilename)};
-  const long Hertz{sysconf(_SC_CLK_TCK)};
 
-  return UpTime() - start_time / static_cast<double>(Hertz);
+  return UpTime() - start_time / static_cast<double>(Hertz());
+}
+
+// Read and return the 1, 5 and 15 minute load averages
+LinuxParser::LoadAverage LinuxParser::LoadAvg() {
+  LoadAverage load{};
+  ifstream stream(kProcDirectory + kLoadavgFilename);
+  if (stream.is_open()) stream >> load.one >> load.five >> load.fifteen;
+  return load;
+}
+
+// Read and return the avg10 stall percentages of a PSI resource
+// (cpu, memory or io); unavailable on kernels without PSI
+LinuxParser::Pressure LinuxParser::PressureStall(string const& resource) {
+  Pressure pressure{};
+  string line, kind, key;
+  float value;
+  ifstream filestream(kProcDirectory + kPressureDirectory + resource);
+  while (getline(filestream, line)) {
+    pressure.available = true;
+    replace(line.begin(), line.end(), '=', ' ');
+    istringstream linestream(line);
+    linestream >> kind;
+    while (linestream >> key >> value) {
+      if (key != fAvg10) continue;
+      if (kind == fPressureSome) pressure.some = value;
+      if (kind == fPressureFull) pressure.full = value;
+      break;
+    }
+  }
+  return pressure;
+}
+
+// Read and return received/transmitted bytes of every non-loopback interface
+vector<LinuxParser::IoCounters> LinuxParser::NetDevices() {
+  vector<IoCounters> devices;
+  string line, temp;
+  ifstream filestream(kProcDirectory + kNetDevFilename);
+
+  // skip the two header lines
+  getline(filestream, line);
+  getline(filestream, line);
+  while (getline(filestream, line)) {
+    replace(line.begin(), line.end(), ':', ' ');
+    istringstream linestream(line);
+    IoCounters device;
+    linestream >> device.name >> device.in;
+    // rx: bytes packets errs drop fifo frame compressed multicast, then tx
+    for (size_t i = 0; i < 7; i++) linestream >> temp;
+    linestream >> device.out;
+    if (device.name != fLoopback) devices.emplace_back(device);
+  }
+  return devices;
+}
+
+// Read and return bytes read/written of every whole disk that saw I/O;
+// partitions (no /sys/block entry) and loop/ram/zram devices are skipped
+vector<LinuxParser::IoCounters> LinuxParser::DiskStats() {
+  vector<IoCounters> disks;
+  string line, temp;
+  ifstream filestream(kProcDirectory + kDiskstatsFilename);
+  while (getline(filestream, line)) {
+    istringstream linestream(line);
+    IoCounters disk;
+    llu sectorsRead{}, sectorsWritten{};
+    // major minor name reads merged sectors ms writes merged sectors ...
+    linestream >> temp >> temp >> disk.name >> temp >> temp >> sectorsRead >>
+        temp >> temp >> temp >> sectorsWritten;
+    if (sectorsRead == 0 && sectorsWritten == 0) continue;
+    if (!fs::exists(kSysBlockDirectory + disk.name)) continue;
+    if (any_of(fVirtualDisks.begin(), fVirtualDisks.end(),
+               [&](string const& prefix) {
+                 return disk.name.compare(0, prefix.size(), prefix) == 0;
+               }))
+      continue;
+    disk.in = sectorsRead * kSectorSize;
+    disk.out = sectorsWritten * kSectorSize;
+    disks.emplace_back(disk);
+  }
+  return disks;
 }
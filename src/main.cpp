@@ -1,7 +1,41 @@
+#include <charconv>
+#include <cstring>
+#include <iostream>
+#include <string>
+
 #include "ncurses_display.h"
 #include "system.h"
+#include "text_display.h"
+
+// Usage: monitor [--once] [-n N]
+//   --once  print the top N processes as plain text and exit
+//   -n N    number of processes to show (default 20)
+int main(int argc, char* argv[]) {
+  bool once{false};
+  int n{20};
+  auto usage = [&]() {
+    std::cerr << "usage: " << argv[0] << " [--once] [-n N]\n";
+    return 1;
+  };
+  for (int i = 1; i < argc; ++i) {
+    const std::string arg{argv[i]};
+    if (arg == "--once") {
+      once = true;
+    } else if (arg == "-n" && i + 1 < argc) {
+      // the whole argument must be a positive integer
+      const char* first{argv[++i]};
+      const char* last{first + std::strlen(first)};
+      auto [end, error] = std::from_chars(first, last, n);
+      if (error != std::errc() || end != last || n < 1) return usage();
+    } else {
+      return usage();
+    }
+  }
 
-int main() {
   System system;
-  NCursesDisplay::Display(system);
-}
\ No newline at end of file
+  if (once) {
+    TextDisplay::Display(system, std::cout, n);
+    return 0;
+  }
+  NCursesDisplay::Display(system, n);
+}
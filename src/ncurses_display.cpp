@@ -13,6 +13,14 @@
 using std::string;
 using std::to_string;
 
+// Devices listed per network/disk panel, busiest first
+int constexpr max_devices{4};
+
+// Per-core sparklines are laid out in cells of "cpuNN " + sparkline
+int constexpr core_label_w{6};
+int constexpr core_spark_w{20};
+int constexpr core_cell_w{core_label_w + core_spark_w + 2};
+
 // 50 bars uniformly displayed from 0 - 100 %
 // 2% is one bar(|)
 std::string NCursesDisplay::ProgressBar(float percent) {
@@ -30,6 +38,24 @@ std::string NCursesDisplay::ProgressBar(float percent) {
   return result + " " + display + "/100%";
 }
 
+// Newest `width` samples scaled from 0 to 1 onto ten ASCII levels,
+// right-aligned so the latest sample is always in the last column
+std::string NCursesDisplay::Sparkline(History const& history, int width) {
+  // no '%' among the levels: the result is used as a printw format
+  static const string levels{" .,:-=+*#@"};
+  if (width <= 0) return "";
+  int const size{int(history.Size())};
+  int const count{size < width ? size : width};
+  string result(width - count, ' ');
+
+  for (int i{size - count}; i < size; ++i) {
+    float value{history[i]};
+    value = value < 0 ? 0 : value > 1 ? 1 : value;
+    result += levels[int(value * (levels.size() - 1) + 0.5f)];
+  }
+  return result;
+}
+
 void NCursesDisplay::DisplaySystem(System& system, WINDOW* window) {
   int row{0};
   mvwprintw(window, ++row, 2, ("OS: " + system.OperatingSystem()).c_str());
@@ -37,12 +63,19 @@ void NCursesDisplay::DisplaySystem(System& system, WINDOW* window) {
   mvwprintw(window, ++row, 2, "CPU: ");
   wattron(window, COLOR_PAIR(1));
   mvwprintw(window, row, 10, "");
-  wprintw(window, ProgressBar(system.Cpu().Utilization()).c_str());
+  // latest history sample, so the bar matches the sparkline
+  wprintw(window, ProgressBar(system.CpuHistory().Empty()
+                                  ? system.Cpu().Utilization()
+                                  : system.CpuHistory().Back())
+                      .c_str());
   wattroff(window, COLOR_PAIR(1));
   mvwprintw(window, ++row, 2, "Memory: ");
   wattron(window, COLOR_PAIR(1));
   mvwprintw(window, row, 10, "");
-  wprintw(window, ProgressBar(system.MemoryUtilization()).c_str());
+  wprintw(window, ProgressBar(system.MemoryHistory().Empty()
+                                  ? system.MemoryUtilization()
+                                  : system.MemoryHistory().Back())
+                      .c_str());
   wattroff(window, COLOR_PAIR(1));
   mvwprintw(window, ++row, 2,
             ("Total Processes: " + to_string(system.TotalProcesses())).c_str());
@@ -54,26 +87,136 @@ void NCursesDisplay::DisplaySystem(System& system, WINDOW* window) {
   wrefresh(window);
 }
 
-void NCursesDisplay::DisplayProcesses(std::vector<Process>& processes,
+// Rows needed by the cpu, memory and per-core sparklines plus the border
+int NCursesDisplay::HistoryHeight(System const& system, int width) {
+  int const cores{int(system.CoreHistory().size())};
+  int per_row{(width - 4) / core_cell_w};
+  if (per_row < 1) per_row = 1;
+  return 2 + 2 + (cores + per_row - 1) / per_row;
+}
+
+void NCursesDisplay::DisplayHistory(System const& system, WINDOW* window) {
+  int row{0};
+  int const width{getmaxx(window)};
+  int const spark_w{width - 14};
+  wattron(window, COLOR_PAIR(1));
+  mvwprintw(window, ++row, 2, "CPU:");
+  mvwprintw(window, row, 10, Sparkline(system.CpuHistory(), spark_w).c_str());
+  mvwprintw(window, ++row, 2, "Memory:");
+  mvwprintw(window, row, 10,
+            Sparkline(system.MemoryHistory(), spark_w).c_str());
+  wattroff(window, COLOR_PAIR(1));
+
+  auto const& cores = system.CoreHistory();
+  int per_row{(width - 4) / core_cell_w};
+  if (per_row < 1) per_row = 1;
+  for (int i = 0; i < int(cores.size()); ++i) {
+    int const column{2 + (i % per_row) * core_cell_w};
+    if (i % per_row == 0) ++row;
+    mvwprintw(window, row, column, ("cpu" + to_string(i)).c_str());
+    wattron(window, COLOR_PAIR(1));
+    mvwprintw(window, row, column + core_label_w,
+              Sparkline(cores[i], core_spark_w).c_str());
+    wattroff(window, COLOR_PAIR(1));
+  }
+  box(window, 0, 0);
+  wrefresh(window);
+}
+
+// Number of rows needed by the enabled panels, including the border
+int NCursesDisplay::PanelsHeight(System& system) {
+  int rows{0};
+  if (system.PanelEnabled(Panel::kLoad)) rows++;
+  if (system.PanelEnabled(Panel::kPressure)) rows += 3;
+  if (system.PanelEnabled(Panel::kNetwork)) rows += 1 + max_devices;
+  if (system.PanelEnabled(Panel::kDisk)) rows += 1 + max_devices;
+  return rows == 0 ? 0 : rows + 2;
+}
+
+void NCursesDisplay::DisplayPanels(System& system, WINDOW* window) {
+  int row{0};
+  auto throughput = [&](string const& title, string const& in,
+                        string const& out,
+                        std::vector<Throughput> const& rates) {
+    wattron(window, COLOR_PAIR(2));
+    mvwprintw(window, ++row, 2, title.c_str());
+    mvwprintw(window, row, 14, in.c_str());
+    mvwprintw(window, row, 26, out.c_str());
+    wattroff(window, COLOR_PAIR(2));
+    for (int i = 0; i < max_devices; ++i) {
+      wmove(window, ++row, 2);
+      wclrtoeol(window);
+      if (i >= int(rates.size())) continue;
+      mvwprintw(window, row, 2, rates[i].name.substr(0, 11).c_str());
+      mvwprintw(window, row, 14, Format::Rate(rates[i].in).c_str());
+      mvwprintw(window, row, 26, Format::Rate(rates[i].out).c_str());
+    }
+  };
+
+  if (system.PanelEnabled(Panel::kLoad)) {
+    auto load = system.LoadAverage();
+    wmove(window, ++row, 2);
+    wclrtoeol(window);
+    mvwprintw(window, row, 2, "Load average: %.2f %.2f %.2f", load.one,
+              load.five, load.fifteen);
+  }
+  if (system.PanelEnabled(Panel::kPressure)) {
+    auto pressure = system.Pressure();
+    char const* resources[]{"cpu", "memory", "io"};
+    for (int i = 0; i < 3; ++i) {
+      wmove(window, ++row, 2);
+      wclrtoeol(window);
+      if (pressure[i].available)
+        mvwprintw(window, row, 2,
+                  "Pressure %-7s some %6.2f%%  full %6.2f%%  (avg10)",
+                  resources[i], pressure[i].some, pressure[i].full);
+      else
+        mvwprintw(window, row, 2, "Pressure %-7s n/a", resources[i]);
+    }
+  }
+  if (system.PanelEnabled(Panel::kNetwork))
+    throughput("NETWORK", "RX", "TX", system.NetThroughput());
+  if (system.PanelEnabled(Panel::kDisk))
+    throughput("DISK", "READ", "WRITE", system.DiskThroughput());
+  box(window, 0, 0);
+  wrefresh(window);
+}
+
+void NCursesDisplay::DisplayProcesses(System const& system,
+                                      std::vector<Process>& processes,
                                       WINDOW* window, int n) {
   int constexpr pid_w = 7;
   int constexpr user_w = 9;
   int constexpr cpu_w = 9;
   int constexpr ram_w = 9;
   int constexpr time_w = 11;
+  int constexpr history_max_w = 22;
+  int constexpr history_min_w = 10;
+  int constexpr command_min_w = 20;
   int row{0};
   int const pid_column{2};
   int const user_column{pid_column + pid_w};
   int const cpu_column{user_column + user_w};
   int const ram_column{cpu_column + cpu_w};
   int const time_column{ram_column + ram_w};
-  int const command_column{time_column + time_w};
+  int const history_column{time_column + time_w};
+  // the sparkline only takes the room COMMAND can spare, and is hidden on
+  // windows too narrow for a useful one
+  int history_w{window->_maxx - history_column - command_min_w};
+  if (history_w > history_max_w) history_w = history_max_w;
+  if (history_w < history_min_w) history_w = 0;
+  int const command_column{history_column + history_w};
+  int command_w{window->_maxx - command_column};
+  if (command_w < 0) command_w = 0;
   wattron(window, COLOR_PAIR(2));
   mvwprintw(window, ++row, pid_column, "PID");
   mvwprintw(window, row, user_column, "USER");
   mvwprintw(window, row, cpu_column, "CPU[%%]");
   mvwprintw(window, row, ram_column, "RAM[MB]");
   mvwprintw(window, row, time_column, "TIME+");
+  if (history_w)
+    mvwprintw(window, row, history_column,
+              history_w > 12 ? "CPU HISTORY" : "HISTORY");
   mvwprintw(window, row, command_column, "COMMAND");
   wattroff(window, COLOR_PAIR(2));
   int const num_processes = int(processes.size()) > n ? n : processes.size();
@@ -85,33 +228,85 @@ void NCursesDisplay::DisplayProcesses(std::vector<Process>& processes,
     mvwprintw(window, row, ram_column, processes[i].Ram().c_str());
     mvwprintw(window, row, time_column,
               Format::ElapsedTime(processes[i].UpTime()).c_str());
+    auto history = system.ProcessHistory(processes[i]);
+    if (history_w) {
+      string const spark{history ? Sparkline(*history, history_w - 2)
+                                 : string(history_w - 2, ' ')};
+      mvwprintw(window, row, history_column, spark.c_str());
+    }
     mvwprintw(window, row, command_column,
-              processes[i].Command().substr(0, window->_maxx - 46).c_str());
+              processes[i].Command().substr(0, command_w).c_str());
   }
 }
 
+// Keys l, p, n and d toggle the load, pressure, network and disk panels
 void NCursesDisplay::Display(System& system, int n) {
   initscr();      // start ncurses
   noecho();       // do not print input values
   cbreak();       // terminate ncurses on ctrl + c
   start_color();  // enable color
+  timeout(1000);  // wait up to one refresh interval for a key
 
   int x_max{getmaxx(stdscr)};
   WINDOW* system_window = newwin(9, x_max - 1, 0, 0);
-  WINDOW* process_window =
-      newwin(3 + n, x_max - 1, system_window->_maxy + 1, 0);
+  int const history_h{HistoryHeight(system, x_max - 1)};
+  WINDOW* history_window =
+      newwin(history_h, x_max - 1, system_window->_maxy + 1, 0);
+  WINDOW* panel_window{nullptr};
+  WINDOW* process_window{nullptr};
+  bool layout_changed{true};
 
   while (1) {
+    if (layout_changed) {
+      // panels change height when toggled, so rebuild the windows below
+      if (panel_window) delwin(panel_window);
+      if (process_window) delwin(process_window);
+      int const panel_y{system_window->_maxy + 1 + history_h};
+      int const panel_h{PanelsHeight(system)};
+      panel_window = panel_h ? newwin(panel_h, x_max - 1, panel_y, 0) : nullptr;
+      process_window = newwin(3 + n, x_max - 1, panel_y + panel_h, 0);
+      clear();
+      refresh();
+      touchwin(system_window);
+      if (history_window) touchwin(history_window);
+      layout_changed = false;
+    }
+
     init_pair(1, COLOR_BLUE, COLOR_BLACK);
     init_pair(2, COLOR_GREEN, COLOR_BLACK);
     box(system_window, 0, 0);
-    box(process_window, 0, 0);
+    if (process_window) box(process_window, 0, 0);
+    // sample once per tick; every window below reads from the samples
+    auto& processes = system.Processes();
+    system.Sample(n);
     DisplaySystem(system, system_window);
-    DisplayProcesses(system.Processes(), process_window, n);
+    if (history_window) DisplayHistory(system, history_window);
+    if (panel_window) DisplayPanels(system, panel_window);
+    if (process_window) {
+      DisplayProcesses(system, processes, process_window, n);
+      wrefresh(process_window);
+    }
     wrefresh(system_window);
-    wrefresh(process_window);
     refresh();
-    std::this_thread::sleep_for(std::chrono::seconds(1));
+
+    switch (getch()) {
+      case 'l':
+        system.TogglePanel(Panel::kLoad);
+        layout_changed = true;
+        break;
+      case 'p':
+        system.TogglePanel(Panel::kPressure);
+        layout_changed = true;
+        break;
+      case 'n':
+        system.TogglePanel(Panel::kNetwork);
+        layout_changed = true;
+        break;
+      case 'd':
+        system.TogglePanel(Panel::kDisk);
+        layout_changed = true;
+        break;
+    }
   }
   endwin();
 }
@@ -2,6 +2,7 @@
 
 #include <unistd.h>
 
+#include <algorithm>
 #include <cctype>
 #include <sstream>
 #include <string>
@@ -9,36 +10,69 @@
 
 using namespace std;
 
-Process::Process(int pid) : pid_{pid} {}
+Process::Process(int pid, LinuxParser::ProcStat const& stat, long upTime)
+    : pid_{pid}, startTime_{stat.startTime}, comm_{stat.comm} {
+  Update(stat, upTime);
+}
+
+// A changed executable name means the pid exec'd: command line and user
+// are reloaded on next use. pid + start time identify the process itself.
+void Process::Update(LinuxParser::ProcStat const& stat, long upTime) {
+  if (stat.comm != comm_) {
+    comm_ = stat.comm;
+    commandLoaded_ = userLoaded_ = false;
+  }
+
+  jiffies_ = stat.activeJiffies;
+  const long Hertz{LinuxParser::Hertz()};
+  upTime_ = upTime - static_cast<long>(startTime_ / Hertz);
+  cpu_ = upTime_ > 0
+             ? static_cast<float>(stat.activeJiffies) / Hertz / upTime_
+             : 0.0f;
+}
+
+LinuxParser::llu Process::StartTime() const { return startTime_; }
+
+long Process::ActiveJiffies() const { return jiffies_; }
 
 // DONE: Return this process's ID
 int Process::Pid() const { return pid_; }
 
 // DONE: Return this process's CPU utilization
-float Process::CpuUtilization() const {
-  const long totalTime{LinuxParser::ActiveJiffies(pid_)};
-  const long Hertz{sysconf(_SC_CLK_TCK)};
-  const long seconds{UpTime()};
-  return static_cast<float>(totalTime) / Hertz / seconds;
-}
+float Process::CpuUtilization() const { return cpu_; }
 
 // DONE: Return the command that generated this process
 string Process::Command() {
-  auto command = LinuxParser::Command(pid_);
+  if (!commandLoaded_) {
+    command_ = LinuxParser::Command(pid_);
 
-  // truncate command if it exceeds the maximum length
-  return command.length() > COMMAND_MAX ? command.substr(0, COMMAND_MAX) + "..."
-                                        : command;
+    // cmdline separates arguments with NUL bytes
+    replace(command_.begin(), command_.end(), '\0', ' ');
+    while (!command_.empty() && command_.back() == ' ') command_.pop_back();
+
+    // truncate command if it exceeds the maximum length
+    if (command_.length() > COMMAND_MAX)
+      command_ = command_.substr(0, COMMAND_MAX) + "...";
+    command_.shrink_to_fit();
+    commandLoaded_ = true;
+  }
+  return command_;
 }
 
 // DONE: Return this process's memory utilization
 string Process::Ram() { return LinuxParser::Ram(pid_); }
 
 // DONE: Return the user (name) that generated this process
-string Process::User() { return LinuxParser::User(pid_); }
+string Process::User() {
+  if (!userLoaded_) {
+    user_ = LinuxParser::User(pid_);
+    userLoaded_ = true;
+  }
+  return user_;
+}
 
 // DONE: Return the age of this process (in seconds)
-long int Process::UpTime() const { return LinuxParser::UpTime(pid_); }
+long int Process::UpTime() const { return upTime_; }
 
 // DONE: Overload the "less than" comparison operator for Process objects
 bool Process::operator<(Process const& a) const {
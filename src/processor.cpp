@@ -1,16 +1,37 @@
 #include "processor.h"
 
 // DONE: Return the aggregate CPU utilization
-float Processor::Utilization() {
-  long prevTotal{LinuxParser::Jiffies()};
-  long prevNonIdle{LinuxParser::ActiveJiffies()};
+float Processor::Utilization(std::chrono::milliseconds interval) {
+  // one /proc/stat pass per sample; the aggregate line comes first
+  auto prev = LinuxParser::CpuTimes();
 
-  std::this_thread::sleep_for(200ms);
+  std::this_thread::sleep_for(interval);
 
-  const long total{LinuxParser::Jiffies()};
-  const long nonIdle{LinuxParser::ActiveJiffies()};
-  const long totald{total - prevTotal};
-  const long totalNonIdeld{nonIdle - prevNonIdle};
+  auto now = LinuxParser::CpuTimes();
+  if (prev.empty() || now.empty()) return 0;
+  const long totald{now[0].active + now[0].idle - prev[0].active -
+                    prev[0].idle};
+  const long totalNonIdeld{now[0].active - prev[0].active};
 
-  return static_cast<float>(totalNonIdeld) / totald;
+  return totald > 0 ? static_cast<float>(totalNonIdeld) / totald : 0;
+}
+
+float Processor::Utilization(LinuxParser::CpuTime const& since,
+                             long minJiffies) {
+  // give up waiting after a second in case the counters are stuck
+  constexpr int kMaxPolls{200};
+  LinuxParser::CpuTime now{since};
+  long totald{0};
+
+  for (int poll = 0; poll < kMaxPolls; poll++) {
+    auto times = LinuxParser::CpuTimes();
+    if (times.empty()) return 0;
+    now = times[0];
+    totald = now.active + now.idle - since.active - since.idle;
+    if (totald >= minJiffies) break;
+    std::this_thread::sleep_for(5ms);
+  }
+
+  return totald > 0 ? static_cast<float>(now.active - since.active) / totald
+                    : 0;
 }
@@ -14,34 +14,102 @@
 
 using namespace std;
 
-// Initialize cpu and pids
-System::System() : cpu_{Processor()}, pids_{LinuxParser::Pids()} {}
+namespace {
+// Convert cumulative counters into per-second rates against the previous
+// sample, then keep the current counters for the next call. Devices seen for
+// the first time report zero until they have a baseline. Sorted by total
+// throughput, descending.
+vector<Throughput> Rates(vector<LinuxParser::IoCounters> const& counters,
+                         unordered_map<string, LinuxParser::IoCounters>& prev,
+                         chrono::steady_clock::time_point& prevTime) {
+  const auto now{chrono::steady_clock::now()};
+  const float seconds{chrono::duration<float>(now - prevTime).count()};
+  vector<Throughput> rates;
+  rates.reserve(counters.size());
+
+  for (auto const& device : counters) {
+    Throughput rate{device.name};
+    auto it = prev.find(device.name);
+    // counters that went backwards (device re-created) restart at zero
+    if (it != prev.end() && seconds > 0 && device.in >= it->second.in &&
+        device.out >= it->second.out) {
+      rate.in = (device.in - it->second.in) / seconds;
+      rate.out = (device.out - it->second.out) / seconds;
+    }
+    rates.emplace_back(rate);
+  }
+
+  prev.clear();
+  for (auto const& device : counters) prev.emplace(device.name, device);
+  prevTime = now;
+
+  // Busiest first, so a truncated list keeps the devices that matter
+  stable_sort(rates.begin(), rates.end(),
+              [](Throughput const& a, Throughput const& b) {
+                return a.in + a.out > b.in + b.out;
+              });
+  return rates;
+}
+}  // namespace
+
+// Initialize cpu and pids, read the per-boot identifiers once, and take the
+// baseline for cpu history
+System::System()
+    : cpu_{Processor()},
+      pids_{LinuxParser::Pids()},
+      kernel_{LinuxParser::Kernel()},
+      operatingSystem_{LinuxParser::OperatingSystem()},
+      prevCpuTimes_{LinuxParser::CpuTimes()} {
+  if (!prevCpuTimes_.empty()) coreHistory_.resize(prevCpuTimes_.size() - 1);
+}
 
 // DONE: Return the system's CPU
 Processor& System::Cpu() { return cpu_; }
 
 // DONE: Return a container composed of the system's processes
+// Processes that survive between calls keep their cached static fields; a
+// pid is matched to its previous entry only if its start time is unchanged
 vector<Process>& System::Processes() {
   pids_ = LinuxParser::Pids();
-  processes_.clear();
-
-  for (auto&& pid : pids_) processes_.emplace_back(Process(pid));
+  const long upTime{UpTime()};
+
+  unordered_map<int, size_t> previous;
+  previous.reserve(processes_.size());
+  for (size_t i = 0; i < processes_.size(); i++)
+    previous.emplace(processes_[i].Pid(), i);
+
+  vector<Process> processes;
+  processes.reserve(pids_.size());
+  LinuxParser::ProcStat stat;
+  for (auto&& pid : pids_) {
+    if (!LinuxParser::Stat(pid, stat)) continue;  // exited meanwhile
+
+    auto it = previous.find(pid);
+    if (it != previous.end() &&
+        processes_[it->second].StartTime() == stat.startTime) {
+      processes.emplace_back(move(processes_[it->second]));
+      processes.back().Update(stat, upTime);
+    } else {
+      processes.emplace_back(pid, stat, upTime);
+    }
+  }
+  processes_ = move(processes);
 
   // Sort in descending order (by cpu)
   sort(processes_.begin(), processes_.end(),
-       [](Process a, Process b) { return a > b; });
+       [](Process const& a, Process const& b) { return a > b; });
 
   return processes_;
 }
 
 // DONE: Return the system's kernel identifier (string)
-std::string System::Kernel() { return LinuxParser::Kernel(); }
+std::string System::Kernel() { return kernel_; }
 
 // DONE: Return the system's memory utilization
 float System::MemoryUtilization() { return LinuxParser::MemoryUtilization(); }
 
 // DONE: Return the operating system name
-std::string System::OperatingSystem() { return LinuxParser::OperatingSystem(); }
+std::string System::OperatingSystem() { return operatingSystem_; }
 
 // DONE: Return the number of processes actively running on the system
 int System::RunningProcesses() { return LinuxParser::RunningProcesses(); }
@@ -51,3 +119,118 @@ int System::TotalProcesses() { return LinuxParser::TotalProcesses(); }
 
 // DONE: Return the number of seconds since the system started running
 long System::UpTime() { return LinuxParser::UpTime(); }
+
+// Return the 1, 5 and 15 minute load averages
+LinuxParser::LoadAverage System::LoadAverage() {
+  return LinuxParser::LoadAvg();
+}
+
+// Return the avg10 pressure stall of cpu, memory and io
+array<LinuxParser::Pressure, 3> System::Pressure() {
+  return {LinuxParser::PressureStall("cpu"),
+          LinuxParser::PressureStall("memory"),
+          LinuxParser::PressureStall("io")};
+}
+
+// Return the per-interface network throughput since the previous call
+vector<Throughput> System::NetThroughput() {
+  return Rates(LinuxParser::NetDevices(), net_.counters, net_.time);
+}
+
+// Return the per-disk throughput since the previous call
+vector<Throughput> System::DiskThroughput() {
+  return Rates(LinuxParser::DiskStats(), disk_.counters, disk_.time);
+}
+
+void System::Sample(size_t tracked) {
+  // cpu and cores: utilization since the previous sample
+  auto cpuTimes = LinuxParser::CpuTimes();
+  auto utilization = [](LinuxParser::CpuTime const& now,
+                        LinuxParser::CpuTime const& prev) {
+    const long active{now.active - prev.active},
+        total{active + now.idle - prev.idle};
+    return total > 0 ? static_cast<float>(active) / total : 0.0f;
+  };
+  if (!cpuTimes.empty() && !prevCpuTimes_.empty())
+    cpuHistory_.Push(utilization(cpuTimes[0], prevCpuTimes_[0]));
+  for (size_t i = 0; i < coreHistory_.size(); i++) {
+    if (i + 1 >= cpuTimes.size() || i + 1 >= prevCpuTimes_.size()) break;
+    coreHistory_[i].Push(utilization(cpuTimes[i + 1], prevCpuTimes_[i + 1]));
+  }
+  prevCpuTimes_ = move(cpuTimes);
+
+  memoryHistory_.Push(MemoryUtilization());
+
+  // processes: release slots whose process (pid + start time) left the top,
+  // including a reused pid, then fill free slots
+  tracked = min({tracked, processes_.size(), kTrackedProcesses});
+  auto isTop = [&](TrackedProcess const& slot) {
+    return any_of(processes_.begin(), processes_.begin() + tracked,
+                  [&](Process const& p) {
+                    return p.Pid() == slot.pid &&
+                           p.StartTime() == slot.startTime;
+                  });
+  };
+  for (auto& slot : tracked_) {
+    if (slot.pid != -1 && !isTop(slot)) {
+      slot.pid = -1;
+      slot.cpu.Clear();
+    }
+  }
+  // cpu of a tracked process is its utilization since the previous sample;
+  // a newly tracked (or reused) pid only takes a baseline
+  const auto now{chrono::steady_clock::now()};
+  const float Hertz{static_cast<float>(LinuxParser::Hertz())};
+  for (size_t i = 0; i < tracked; i++) {
+    auto& process = processes_[i];
+    auto slot = find_if(tracked_.begin(), tracked_.end(), [&](auto& s) {
+      return s.pid == process.Pid() && s.startTime == process.StartTime();
+    });
+    if (slot == tracked_.end()) {
+      slot = find_if(tracked_.begin(), tracked_.end(),
+                     [](auto& s) { return s.pid == -1; });
+      if (slot == tracked_.end()) continue;  // cannot happen: tracked <= slots
+      slot->pid = process.Pid();
+      slot->startTime = process.StartTime();
+      slot->cpu.Clear();
+    } else {
+      const float seconds{
+          chrono::duration<float>(now - slot->prevTime).count()};
+      const long jiffies{process.ActiveJiffies() - slot->prevJiffies};
+      slot->cpu.Push(seconds > 0 && jiffies >= 0 ? jiffies / Hertz / seconds
+                                                 : 0.0f);
+    }
+    slot->prevJiffies = process.ActiveJiffies();
+    slot->prevTime = now;
+  }
+}
+
+LinuxParser::CpuTime System::CpuBaseline() const {
+  return prevCpuTimes_.empty() ? LinuxParser::CpuTime{} : prevCpuTimes_[0];
+}
+
+History const& System::CpuHistory() const { return cpuHistory_; }
+
+vector<History> const& System::CoreHistory() const { return coreHistory_; }
+
+History const& System::MemoryHistory() const { return memoryHistory_; }
+
+History const* System::ProcessHistory(Process const& process) const {
+  for (auto const& slot : tracked_)
+    if (slot.pid == process.Pid() && slot.startTime == process.StartTime())
+      return &slot.cpu;
+  return nullptr;
+}
+
+bool System::PanelEnabled(Panel panel) const {
+  return panels_[static_cast<int>(panel)];
+}
+
+// Switch a panel on or off; a panel turned off forgets its previous samples
+// so that turning it back on does not average over the time it was hidden
+void System::TogglePanel(Panel panel) {
+  auto& enabled = panels_[static_cast<int>(panel)];
+  enabled = !enabled;
+  if (panel == Panel::kNetwork) net_.counters.clear();
+  if (panel == Panel::kDisk) disk_.counters.clear();
+}
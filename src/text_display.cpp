@@ -0,0 +1,57 @@
+#include "text_display.h"
+
+#include <iomanip>
+#include <string>
+#include <vector>
+
+#include "format.h"
+
+using namespace std;
+
+// Jiffies per core the cpu sample must span: 10 at USER_HZ=100 is ~100 ms,
+// i.e. a resolution of 10% instead of the 50% a bare 20 ms sample gives
+constexpr long kMinJiffiesPerCore{10};
+
+void TextDisplay::Display(System& system, ostream& out, int n) {
+  // The System constructor took a /proc/stat baseline, so the process scan
+  // doubles as the cpu sample window; only a short scan has to wait
+  auto& processes = system.Processes();
+  const long cores{max<long>(1, system.CoreHistory().size())};
+  const float cpu{system.Cpu().Utilization(system.CpuBaseline(),
+                                           kMinJiffiesPerCore * cores)};
+  const auto load{system.LoadAverage()};
+
+  out << fixed << setprecision(1);
+  out << "OS: " << system.OperatingSystem() << "\n"
+      << "Kernel: " << system.Kernel() << "\n"
+      << "CPU: " << cpu * 100 << "%  Memory: "
+      << system.MemoryUtilization() * 100 << "%\n"
+      << "Processes: " << system.TotalProcesses() << " total, "
+      << system.RunningProcesses() << " running\n"
+      << "Up Time: " << Format::ElapsedTime(system.UpTime()) << "\n"
+      << setprecision(2) << "Load average: " << load.one << " " << load.five
+      << " " << load.fifteen << "\n\n";
+
+  // Every fixed-width column ends in a space so the output always splits on
+  // whitespace: numbers may widen their column, user names are truncated
+  int constexpr pid_w = 8;
+  int constexpr user_w = 9;
+  int constexpr cpu_w = 9;
+  int constexpr ram_w = 9;
+  int constexpr time_w = 11;
+  out << left << setw(pid_w - 1) << "PID" << ' ' << setw(user_w - 1) << "USER"
+      << ' ' << setw(cpu_w - 1) << "CPU[%]" << ' ' << setw(ram_w - 1)
+      << "RAM[MB]" << ' ' << setw(time_w - 1) << "TIME+" << ' '
+      << "COMMAND\n";
+
+  int const num_processes = int(processes.size()) > n ? n : processes.size();
+  for (int i = 0; i < num_processes; ++i) {
+    auto& process = processes[i];
+    out << setw(pid_w - 1) << process.Pid() << ' ' << setw(user_w - 1)
+        << process.User().substr(0, user_w - 1) << ' ' << setprecision(1)
+        << setw(cpu_w - 1) << process.CpuUtilization() * 100 << ' '
+        << setw(ram_w - 1) << process.Ram() << ' ' << setw(time_w - 1)
+        << Format::ElapsedTime(process.UpTime()) << ' ' << process.Command()
+        << "\n";
+  }
+}